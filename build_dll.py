@@ -1,27 +1,63 @@
 import subprocess
-from typing import List
+import sys
+from typing import List, Tuple
 
 ROOT_SRC: str = "./src/c/"
 ROOT_DLL: str = "./src/a_to_b/dlls/"
-source_files: List[str] = [ROOT_SRC + "overlay_window.cpp"]
-output_files: List[str] = [ROOT_DLL + "overlay_window.dll"]
 
-for sfile, ofile in zip(source_files, output_files):
-    result: int = subprocess.call(
+# (source, output, per-target arguments).
+Target = Tuple[str, str, List[str]]
+
+if sys.platform == "win32":
+    WIN_LIBS: List[str] = ["d3d11.lib", "dxgi.lib", "dcomp.lib", "user32.lib"]
+    targets: List[Target] = [
+        (ROOT_SRC + "overlay_window.cpp", ROOT_DLL + "overlay_window.dll", WIN_LIBS),
+        (ROOT_SRC + "screen_capture.cpp", ROOT_DLL + "screen_capture.dll", WIN_LIBS),
+        (ROOT_SRC + "hit_probability.cpp", ROOT_DLL + "hit_probability.dll", []),
+    ]
+    commands: List[List[str]] = [
+        ["clang-cl", "/std:c++17", "/O2", "/DNDEBUG", "/LD", "/EHsc", sfile, f"/Fe{ofile}", *args]
+        for sfile, ofile, args in targets
+    ]
+else:
+    targets: List[Target] = [
+        # X11 MIT-SHM capture backend requires libx11, libxext and libxdamage headers.
+        (
+            ROOT_SRC + "screen_capture_x11.cpp",
+            ROOT_DLL + "screen_capture.so",
+            ["-O2", "-lX11", "-lXext", "-lXdamage"],
+        ),
+        (
+            ROOT_SRC + "hit_probability.cpp",
+            ROOT_DLL + "hit_probability.so",
+            # Lets the sampling kernels vectorize.
+            ["-O3", "-fno-math-errno", "-fno-trapping-math", "-pthread"],
+        ),
+    ]
+    commands: List[List[str]] = [
         [
-            "clang-cl",
-            "/O2",
-            "/DNDEBUG",
-            "/LD",
-            "/EHsc",
+            "c++",
+            "-std=c++17",
+            "-DNDEBUG",
+            "-shared",
+            "-fPIC",
+            "-fvisibility=hidden",
             sfile,
-            f"/Fe{ofile}",
-            "d3d11.lib",
-            "dxgi.lib",
-            "dcomp.lib",
-            "user32.lib",
+            "-o",
+            ofile,
+            *args,
         ]
-    )
-    if result:
-        break
+        for sfile, ofile, args in targets
+    ]
+
+# Build every target even if one fails, report failures at the end.
+failed: List[str] = []
+for (sfile, _, _), command in zip(targets, commands):
+    result: int = subprocess.call(command)
     print(f"Building {sfile}... -> Return Code: {result}")
+    if result:
+        failed.append(sfile)
+
+if failed:
+    print(f"Failed: {', '.join(failed)}")
+    sys.exit(1)
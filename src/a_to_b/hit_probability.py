@@ -0,0 +1,97 @@
+import ctypes
+import sys
+import numpy as np
+
+from numpy.typing import NDArray
+from typing import Tuple
+from pathlib import Path
+
+
+HPDLL_NAME: str = "hit_probability.dll" if sys.platform == "win32" else "hit_probability.so"
+HPDLL_PATH: Path = Path(__file__).parent / "dlls" / HPDLL_NAME
+HPDLL: ctypes.CDLL = ctypes.CDLL(HPDLL_PATH)
+
+# --- API Definition --- #
+
+# HRESULT create_hit_estimator(HitEstimator**, int)
+HPDLL.create_hit_estimator.restype = ctypes.c_int32  # HRESULT, 32-bit on every platform.
+HPDLL.create_hit_estimator.argtypes = (
+    ctypes.c_void_p,  # Class pointer out-parameter.
+    ctypes.c_int,  # Thread count, <= 0 for all hardware threads.
+)
+
+# HRESULT estimate_hit_probability(HitEstimator*, const TargetState*, int, float, float,
+#                                  const float*, int, uint64_t, HitEstimate*)
+HPDLL.estimate_hit_probability.restype = ctypes.c_int32
+HPDLL.estimate_hit_probability.argtypes = (
+    ctypes.c_void_p,  # Class pointer.
+    ctypes.c_void_p,  # Targets, (N, TARGET_FIELDS) float32.
+    ctypes.c_int,  # Target count.
+    ctypes.c_float,  # Projectile speed.
+    ctypes.c_float,  # Angular dispersion, 1-sigma radians.
+    ctypes.c_void_p,  # Gravity, (3,) float32.
+    ctypes.c_int,  # Samples per target.
+    ctypes.c_uint64,  # Seed.
+    ctypes.c_void_p,  # Estimates out, (N, ESTIMATE_FIELDS) float32.
+)
+
+# void destroy_hit_estimator(HitEstimator**)
+HPDLL.destroy_hit_estimator.restype = None
+HPDLL.destroy_hit_estimator.argtypes = (ctypes.c_void_p,)
+
+# Row layout of TargetState: position[3], velocity[3], position_sigma[3], velocity_sigma[3], radius.
+TARGET_FIELDS: int = 13
+# Row layout of HitEstimate: probability, std_error, time_of_flight, aim_point[3], bias[2],
+# sigma_major, sigma_minor, angle.
+ESTIMATE_FIELDS: int = 11
+
+
+class HitEstimator:
+    """
+    Wrapper around the native Monte Carlo hit-probability estimator.
+    - Right-handed, y-up frame with the shooter at the origin. SI units.
+    - Constant-velocity targets, drag-free projectiles under constant gravity.
+    - Results for a fixed seed are reproducible regardless of thread count.
+    - A negative time of flight marks a target with no intercept (probability 0).
+    """
+    _class_handle: ctypes.c_void_p = ctypes.c_void_p()
+
+    def __init__(self, n_threads: int = 0) -> None:
+        self._class_handle = ctypes.c_void_p()
+        hr: int = HPDLL.create_hit_estimator(ctypes.byref(self._class_handle), n_threads)
+        if hr < 0:
+            raise SystemError(f"HRESULT: {hr:#x}")
+
+    def estimate(
+        self,
+        targets: NDArray,
+        speed: float,
+        dispersion: float,
+        gravity: NDArray | Tuple[float, float, float] = (0.0, -9.81, 0.0),
+        n_samples: int = 4096,
+        seed: int = 0,
+    ) -> NDArray:
+        """
+        Estimates the hit probability of every target row.
+        Returns an (N, ESTIMATE_FIELDS) float32 array.
+        """
+        tgt: NDArray = np.ascontiguousarray(targets, dtype=np.float32).reshape(-1, TARGET_FIELDS)
+        grv: NDArray = np.ascontiguousarray(gravity, dtype=np.float32).reshape(3)
+        out: NDArray = np.zeros((tgt.shape[0], ESTIMATE_FIELDS), dtype=np.float32)
+        hr: int = HPDLL.estimate_hit_probability(
+            self._class_handle,
+            tgt.ctypes.data_as(ctypes.c_void_p),
+            tgt.shape[0],
+            speed,
+            dispersion,
+            grv.ctypes.data_as(ctypes.c_void_p),
+            n_samples,
+            seed,
+            out.ctypes.data_as(ctypes.c_void_p),
+        )
+        if hr < 0:
+            raise SystemError(f"HRESULT: {hr:#x}")
+        return out
+
+    def __del__(self) -> None:
+        HPDLL.destroy_hit_estimator(ctypes.byref(self._class_handle))
@@ -1,23 +1,24 @@
 import ctypes
+import sys
 import numpy as np
 
-from win32con import SM_CXSCREEN, SM_CYSCREEN
-from win32api import GetSystemMetrics
 from numpy.typing import NDArray
 from pathlib import Path
 
 
-SCRDLL_PATH: Path = Path(__file__).parent / "dlls" / "screen_capture.dll"
+# DXGI backend on Windows, X11 MIT-SHM backend everywhere else.
+SCRDLL_NAME: str = "screen_capture.dll" if sys.platform == "win32" else "screen_capture.so"
+SCRDLL_PATH: Path = Path(__file__).parent / "dlls" / SCRDLL_NAME
 SCRDLL: ctypes.CDLL = ctypes.CDLL(SCRDLL_PATH)
 
 # --- API Definition --- #
 
 # HRESULT create_screen_capture_object(ScreenCapture**)
-SCRDLL.create_screen_capture_object.restype = ctypes.c_long
+SCRDLL.create_screen_capture_object.restype = ctypes.c_int32  # HRESULT, 32-bit on every platform.
 SCRDLL.create_screen_capture_object.argtypes = (ctypes.c_void_p,)
 
 # HRESULT capture_frame(ScreenCapture*, void*, int, int, int)
-SCRDLL.capture_frame.restype = ctypes.c_long
+SCRDLL.capture_frame.restype = ctypes.c_int32
 SCRDLL.capture_frame.argtypes = (
     ctypes.c_void_p,  # Class pointer.
     ctypes.c_void_p,  # Data pointer.
@@ -26,16 +27,26 @@ SCRDLL.capture_frame.argtypes = (
     ctypes.c_int,  # Depth / Channels (Must be 4 for BGRA).
 )
 
+# HRESULT get_frame_size(ScreenCapture*, int*, int*)
+SCRDLL.get_frame_size.restype = ctypes.c_int32
+SCRDLL.get_frame_size.argtypes = (
+    ctypes.c_void_p,  # Class pointer.
+    ctypes.c_void_p,  # Width out-pointer.
+    ctypes.c_void_p,  # Height out-pointer.
+)
+
 # void destroy_screen_capture_object(ScreenCapture**)
 SCRDLL.destroy_screen_capture_object.restype = None
 SCRDLL.destroy_screen_capture_object.argtypes = (ctypes.c_void_p,)
 
 N_CHANNELS: int = 4
+WAIT_TIMEOUT: int = 0x887A0027 - (1 << 32)  # DXGI_ERROR_WAIT_TIMEOUT as a signed HRESULT.
 
 
 class ScreenCapture:
     """
-    Wrapper around a custom screen-capture DLL with a DXGI Desktop-Duplication backend.
+    Wrapper around a custom screen-capture DLL with a DXGI Desktop-Duplication backend,
+    or an X11 MIT-SHM backend on Linux (headless-capable under Xvfb).
     - This does not support monitors with scaling other than 100%. 
     - A `DXGI_ERROR_LOST` will result in undefined behavior (UAC prompt, Ctrl+Alt+Del, etc.)
     - Performance differs heavily under memory pressure.
@@ -53,15 +64,20 @@ class ScreenCapture:
         hr: int = SCRDLL.create_screen_capture_object(ctypes.byref(self._class_handle))
         if hr < 0:
             raise SystemError(f"HRESULT: {hr:#x}")
-        self._sx = GetSystemMetrics(SM_CXSCREEN)
-        self._sy = GetSystemMetrics(SM_CYSCREEN)
+        sx, sy = ctypes.c_int(), ctypes.c_int()
+        hr = SCRDLL.get_frame_size(self._class_handle, ctypes.byref(sx), ctypes.byref(sy))
+        if hr < 0:
+            raise SystemError(f"HRESULT: {hr:#x}")
+        self._sx = sx.value
+        self._sy = sy.value
         self._buffer = np.resize(self._buffer, (self._sy, self._sx, N_CHANNELS))
         self._buffer.flags.writeable = False
 
     def capture(self) -> NDArray:
         """
         Captures a frame and returns a read-only reference to its
-        internal buffer.
+        internal buffer. The buffer is left as-is when no new
+        frame is available.
         """
         hr: int = SCRDLL.capture_frame(
             self._class_handle,
@@ -70,7 +86,7 @@ class ScreenCapture:
             self._sy,
             N_CHANNELS
         )
-        if hr < 0 and hr != 0x887a0027: # DXGI_ERROR_WAIT_TIMEOUT
+        if hr < 0 and hr != WAIT_TIMEOUT:
             raise SystemError(f"HRESULT: {hr:#x}")
         return self._buffer
 
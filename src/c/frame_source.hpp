@@ -0,0 +1,82 @@
+/**
+ * @brief
+ * Platform-neutral frame-source interface shared by
+ * the screen capture backends.
+ *
+ * @remarks
+ * - Every backend exports the same C ABI declared below, so the
+ *   Python wrapper does not need to know which one it is loading.
+ * - An unchanged frame is reported as DXGI_ERROR_WAIT_TIMEOUT,
+ *   in which case the caller's buffer is left untouched.
+ */
+
+#pragma once
+
+#include "platform.hpp"
+
+class FrameSource {
+   public:
+    FrameSource() = default;
+    FrameSource(const FrameSource &) = delete;
+    FrameSource &operator=(const FrameSource &) = delete;
+    FrameSource(FrameSource &&) = delete;
+    FrameSource &operator=(FrameSource &&) = delete;
+    virtual ~FrameSource() = default;
+
+    /**
+     * @brief Primary initializer.
+     */
+    virtual HRESULT initialize() = 0;
+
+    /**
+     * @brief
+     * Capture frame call. Copies the current frame
+     * onto data out-parameter. Caller must provide size of
+     * data pointer in width and height and must ensure
+     * data is contiguous in memory.
+     */
+    virtual HRESULT capture_frame(void *data, int dx, int dy, int dz) = 0;
+
+    /**
+     * @brief Width of the captured output in pixels.
+     */
+    virtual int width() const noexcept = 0;
+
+    /**
+     * @brief Height of the captured output in pixels.
+     */
+    virtual int height() const noexcept = 0;
+};
+
+extern "C" {
+
+/**
+ * @brief
+ * Primary entry point. Creates the backend's object on memory
+ * and provides a handle to the caller.
+ */
+DLL_EXPORT HRESULT create_screen_capture_object(FrameSource **out) noexcept;
+
+/**
+ * @brief
+ * Capture current frame on the current buffer.
+ *
+ * @note
+ * Data must be equal to the size of the monitor's resolution.
+ * It must be formatted as B8G8R8A8.Behavior is undefined otherwise.
+ */
+DLL_EXPORT HRESULT capture_frame(FrameSource *obj, void *data, int dx, int dy, int dz) noexcept;
+
+/**
+ * @brief
+ * Query the dimensions of the captured output, so callers
+ * can size their buffers without any platform-specific API.
+ */
+DLL_EXPORT HRESULT get_frame_size(FrameSource *obj, int *dx, int *dy) noexcept;
+
+/**
+ * @brief
+ * Destroy screen capture object. Does nothing if a nullptr is passed.
+ */
+DLL_EXPORT void destroy_screen_capture_object(FrameSource **objptr) noexcept;
+}
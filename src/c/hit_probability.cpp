@@ -0,0 +1,746 @@
+/**
+ * @brief
+ * Monte Carlo hit-probability estimator for intercept solutions.
+ *
+ * @remarks
+ * - Right-handed, y-up frame with the shooter at the origin. SI units.
+ * - Target motion is constant-velocity, the projectile is a point mass
+ *   under constant gravity with no drag.
+ * - Each target gets a nominal intercept solved from its mean state. The
+ *   samples then perturb target position, target velocity and the firing
+ *   direction (angular dispersion) with independent Gaussians.
+ * - A sample hits if the projectile's closest approach to the sampled
+ *   target is within the target's radius.
+ * - Randomness comes from Philox4x32-10 keyed by (seed) and countered by
+ *   (sample, target), so every sample is a pure function of its index.
+ *   Chunks are reduced in a fixed order, so results for a fixed seed
+ *   do not depend on the thread count or scheduling.
+ * - Kernels work on fixed-width lane arrays with branch-free math
+ *   (no libm calls) so the compiler can vectorize them.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "platform.hpp"
+
+constexpr int lane_count = 16;
+constexpr int chunk_samples = 4096;  // Samples per work item, multiple of lane_count.
+constexpr int intercept_iterations = 32;
+constexpr int closest_approach_iterations = 3;
+constexpr std::int64_t max_chunks = std::numeric_limits<int>::max() / 2;  // Per estimate call.
+
+/**
+ * @brief
+ * Mean state and 1-sigma per-axis uncertainty of a single target.
+ */
+struct TargetState {
+    float position[3];
+    float velocity[3];
+    float position_sigma[3];
+    float velocity_sigma[3];
+    float radius;
+};
+
+/**
+ * @brief
+ * Per-target result. The ellipse describes the miss vectors of all samples
+ * projected on the plane normal to the firing direction, with x pointing
+ * right and y pointing up as seen from the shooter.
+ */
+struct HitEstimate {
+    float probability;
+    float std_error;       // Binomial standard error of probability.
+    float time_of_flight;  // Negative if no intercept exists.
+    float aim_point[3];    // Nominal lead point, gravity-compensated.
+    float bias[2];         // Mean miss vector.
+    float sigma_major;     // 1-sigma semi-axes.
+    float sigma_minor;
+    float angle;  // Major axis angle from x, radians.
+};
+
+static_assert(sizeof(TargetState) == 13 * sizeof(float), "TargetState must be packed.");
+static_assert(sizeof(HitEstimate) == 11 * sizeof(float), "HitEstimate must be packed.");
+
+class HitEstimator;
+
+extern "C" {
+
+/**
+ * @brief
+ * Primary entry point. Creates the estimator and its worker threads.
+ * A thread count <= 0 uses every hardware thread.
+ */
+DLL_EXPORT HRESULT create_hit_estimator(HitEstimator **out, int n_threads) noexcept;
+
+/**
+ * @brief
+ * Estimates the hit probability of every target.
+ *
+ * @note
+ * gravity must point to 3 floats. out must hold n_targets elements.
+ * dispersion is the 1-sigma angular error of the firing direction in radians.
+ */
+DLL_EXPORT HRESULT estimate_hit_probability(
+    HitEstimator *obj,
+    const TargetState *targets,
+    int n_targets,
+    float speed,
+    float dispersion,
+    const float *gravity,
+    int n_samples,
+    std::uint64_t seed,
+    HitEstimate *out
+) noexcept;
+
+/**
+ * @brief
+ * Destroy estimator object. Does nothing if a nullptr is passed.
+ */
+DLL_EXPORT void destroy_hit_estimator(HitEstimator **objptr) noexcept;
+}
+
+// ------------------------------------ RNG ----------------------------------- //
+
+/**
+ * @brief
+ * Philox4x32-10 over lane arrays. Counters are (sample, target, stream, 0).
+ */
+static void philox4x32(
+    const std::uint32_t *__restrict sample,
+    std::uint32_t target,
+    std::uint32_t stream,
+    std::uint64_t seed,
+    std::uint32_t (*__restrict out)[lane_count]
+) {
+    constexpr std::uint32_t m0 = 0xD2511F53u;
+    constexpr std::uint32_t m1 = 0xCD9E8D57u;
+    constexpr std::uint32_t w0 = 0x9E3779B9u;
+    constexpr std::uint32_t w1 = 0xBB67AE85u;
+    for (int l = 0; l < lane_count; ++l) {
+        std::uint32_t c0 = sample[l];
+        std::uint32_t c1 = target;
+        std::uint32_t c2 = stream;
+        std::uint32_t c3 = 0;
+        std::uint32_t k0 = std::uint32_t(seed);
+        std::uint32_t k1 = std::uint32_t(seed >> 32);
+        for (int r = 0; r < 10; ++r) {
+            const std::uint64_t p0 = std::uint64_t(m0) * c0;
+            const std::uint64_t p1 = std::uint64_t(m1) * c2;
+            const std::uint32_t n0 = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+            const std::uint32_t n2 = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c1 = std::uint32_t(p1);
+            c3 = std::uint32_t(p0);
+            c0 = n0;
+            c2 = n2;
+            k0 += w0;
+            k1 += w1;
+        }
+        out[0][l] = c0;
+        out[1][l] = c1;
+        out[2][l] = c2;
+        out[3][l] = c3;
+    }
+}
+
+/**
+ * @brief
+ * Maps 32 random bits to a float in the open interval (0, 1).
+ * Outputs are odd multiples of 2^-24, all exactly representable.
+ */
+static inline float to_unit(std::uint32_t x) {
+    return float(x >> 9) * (1.0f / 8388608.0f) + (1.0f / 16777216.0f);
+}
+
+static inline std::uint32_t float_bits(float x) {
+    std::uint32_t u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+static inline float bits_float(std::uint32_t u) {
+    float x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+/**
+ * @brief
+ * Natural log for normal, positive floats (Cephes logf).
+ */
+static inline float fast_log(float x) {
+    const std::uint32_t bits = float_bits(x);
+    float e = float(int((bits >> 23) & 0xFF) - 126);
+    float m = bits_float((bits & 0x007FFFFFu) | 0x3F000000u);  // [0.5, 1).
+    const bool low = m < 0.70710678118654752440f;
+    e = low ? e - 1.0f : e;
+    m = low ? m + m - 1.0f : m - 1.0f;
+    const float z = m * m;
+    float y = 7.0376836292e-2f;
+    y = y * m - 1.1514610310e-1f;
+    y = y * m + 1.1676998740e-1f;
+    y = y * m - 1.2420140846e-1f;
+    y = y * m + 1.4249322787e-1f;
+    y = y * m - 1.6668057665e-1f;
+    y = y * m + 2.0000714765e-1f;
+    y = y * m - 2.4999993993e-1f;
+    y = y * m + 3.3333331174e-1f;
+    y = y * m * z;
+    y += -2.12194440e-4f * e;
+    y += -0.5f * z;
+    return m + y + 0.693359375f * e;
+}
+
+/**
+ * @brief
+ * sin(2*pi*u) and cos(2*pi*u) for u in [0, 1) (Cephes sinf/cosf kernels).
+ */
+static inline void fast_sincos_turns(float u, float *s, float *c) {
+    constexpr float half_pi = 1.57079632679489661923f;
+    const float x = u * 4.0f;
+    const int q = int(x + 0.5f);     // Quadrant, 0..4. Truncation is floor here.
+    const float r = (x - float(q)) * half_pi;  // [-pi/4, pi/4].
+    const float z = r * r;
+    float ps = -1.9515295891e-4f;
+    ps = ps * z + 8.3321608736e-3f;
+    ps = ps * z - 1.6666654611e-1f;
+    ps = ps * z * r + r;
+    float pc = 2.443315711809948e-5f;
+    pc = pc * z - 1.388731625493765e-3f;
+    pc = pc * z + 4.166664568298827e-2f;
+    pc = pc * z * z - 0.5f * z + 1.0f;
+    const bool swap = (q & 1) != 0;
+    const float sv = swap ? pc : ps;
+    const float cv = swap ? ps : pc;
+    *s = ((q & 2) != 0) ? -sv : sv;
+    *c = (((q + 1) & 2) != 0) ? -cv : cv;
+}
+
+/**
+ * @brief
+ * Box-Muller over two lane arrays of raw bits. Writes two normal lane arrays.
+ */
+static void box_muller(
+    const std::uint32_t *__restrict a,
+    const std::uint32_t *__restrict b,
+    float *__restrict n0,
+    float *__restrict n1
+) {
+    for (int l = 0; l < lane_count; ++l) {
+        const float r = std::sqrt(-2.0f * fast_log(to_unit(a[l])));
+        float s, c;
+        fast_sincos_turns(to_unit(b[l]), &s, &c);
+        n0[l] = r * c;
+        n1[l] = r * s;
+    }
+}
+
+// -------------------------------- Kinematics -------------------------------- //
+
+/**
+ * @brief
+ * Nominal solution for a target, shared by all of its samples.
+ */
+struct Solution {
+    float dir[3];    // Unit firing direction.
+    float right[3];  // Basis of the plane normal to dir.
+    float up[3];
+    float tof;
+    float aim_point[3];
+    bool valid;
+};
+
+/**
+ * @brief
+ * Solves |p + v*t - g*t^2/2| = s*t by fixed-point iteration on t.
+ * Fails if the target outruns the projectile or the iteration diverges.
+ */
+static Solution solve_intercept(const TargetState &tgt, float speed, const float *gravity) {
+    Solution sol = {};
+    double t = 0.0;
+    double q[3] = {tgt.position[0], tgt.position[1], tgt.position[2]};
+    t = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]) / speed;
+    double qn = 0.0;
+    for (int i = 0; i < intercept_iterations; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            q[a] = tgt.position[a] + tgt.velocity[a] * t - 0.5 * gravity[a] * t * t;
+        }
+        qn = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+        t = qn / speed;
+    }
+    for (int a = 0; a < 3; ++a) {
+        q[a] = tgt.position[a] + tgt.velocity[a] * t - 0.5 * gravity[a] * t * t;
+    }
+    qn = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+    if (!(std::isfinite(qn) && qn > 0.0 && std::abs(qn - speed * t) <= 1e-4 * qn)) {
+        return sol;
+    }
+
+    double d[3] = {q[0] / qn, q[1] / qn, q[2] / qn};
+    // right = d x world_up, falls back to world x when firing straight up/down.
+    double r[3] = {-d[2], 0.0, d[0]};
+    double rn = std::sqrt(r[0] * r[0] + r[2] * r[2]);
+    if (rn < 1e-6) {
+        r[0] = 1.0;
+        r[2] = 0.0;
+        rn = 1.0;
+    }
+    for (double &x : r) {
+        x /= rn;
+    }
+    const double u[3] = {
+        r[1] * d[2] - r[2] * d[1],
+        r[2] * d[0] - r[0] * d[2],
+        r[0] * d[1] - r[1] * d[0],
+    };
+    for (int a = 0; a < 3; ++a) {
+        sol.dir[a] = float(d[a]);
+        sol.right[a] = float(r[a]);
+        sol.up[a] = float(u[a]);
+        sol.aim_point[a] = float(q[a]);
+    }
+    sol.tof = float(t);
+    sol.valid = true;
+    return sol;
+}
+
+/**
+ * @brief
+ * Partial sums of one chunk. Reduced in chunk order for reproducibility.
+ */
+struct ChunkSums {
+    std::uint64_t hits;
+    std::uint64_t count;
+    double sx;
+    double sy;
+    double sxx;
+    double syy;
+    double sxy;
+};
+
+/**
+ * @brief
+ * Propagates one chunk of samples for a single target.
+ */
+static ChunkSums propagate_chunk(
+    const TargetState &tgt,
+    const Solution &sol,
+    float speed,
+    float dispersion,
+    const float *gravity,
+    std::uint32_t target_index,
+    std::uint32_t begin,
+    std::uint32_t end,
+    std::uint64_t seed
+) {
+    alignas(64) std::uint32_t counter[lane_count];
+    alignas(64) std::uint32_t bits_a[4][lane_count];
+    alignas(64) std::uint32_t bits_b[4][lane_count];
+    alignas(64) float n[8][lane_count];  // px py pz vx vy vz dr du.
+    alignas(64) float acc_x[lane_count] = {};
+    alignas(64) float acc_y[lane_count] = {};
+    alignas(64) float acc_xx[lane_count] = {};
+    alignas(64) float acc_yy[lane_count] = {};
+    alignas(64) float acc_xy[lane_count] = {};
+    alignas(64) std::uint32_t acc_hits[lane_count] = {};
+    const float gx = gravity[0];
+    const float gy = gravity[1];
+    const float gz = gravity[2];
+    const float r2 = tgt.radius * tgt.radius;
+
+    for (std::uint32_t base = begin; base < end; base += lane_count) {
+        for (int l = 0; l < lane_count; ++l) {
+            counter[l] = base + std::uint32_t(l);
+        }
+        philox4x32(counter, target_index, 0, seed, bits_a);
+        philox4x32(counter, target_index, 1, seed, bits_b);
+        box_muller(bits_a[0], bits_a[1], n[0], n[1]);
+        box_muller(bits_a[2], bits_a[3], n[2], n[3]);
+        box_muller(bits_b[0], bits_b[1], n[4], n[5]);
+        box_muller(bits_b[2], bits_b[3], n[6], n[7]);
+
+        for (int l = 0; l < lane_count; ++l) {
+            const float px = tgt.position[0] + tgt.position_sigma[0] * n[0][l];
+            const float py = tgt.position[1] + tgt.position_sigma[1] * n[1][l];
+            const float pz = tgt.position[2] + tgt.position_sigma[2] * n[2][l];
+            const float vx = tgt.velocity[0] + tgt.velocity_sigma[0] * n[3][l];
+            const float vy = tgt.velocity[1] + tgt.velocity_sigma[1] * n[4][l];
+            const float vz = tgt.velocity[2] + tgt.velocity_sigma[2] * n[5][l];
+
+            // Small-angle dispersion in the plane normal to the firing direction.
+            const float er = dispersion * n[6][l];
+            const float eu = dispersion * n[7][l];
+            float dx = sol.dir[0] + er * sol.right[0] + eu * sol.up[0];
+            float dy = sol.dir[1] + er * sol.right[1] + eu * sol.up[1];
+            float dz = sol.dir[2] + er * sol.right[2] + eu * sol.up[2];
+            const float dinv = 1.0f / std::sqrt(dx * dx + dy * dy + dz * dz);
+            dx *= dinv;
+            dy *= dinv;
+            dz *= dinv;
+
+            // Relative miss m(t) = w*t + g*t^2/2 - p with w = s*d - v.
+            // Newton on d|m|^2/dt = 0, seeded with the nominal time of flight.
+            const float wx = speed * dx - vx;
+            const float wy = speed * dy - vy;
+            const float wz = speed * dz - vz;
+            float t = sol.tof;
+            for (int i = 0; i < closest_approach_iterations; ++i) {
+                const float ht = 0.5f * t;
+                const float mx = (wx + gx * ht) * t - px;
+                const float my = (wy + gy * ht) * t - py;
+                const float mz = (wz + gz * ht) * t - pz;
+                const float jx = wx + gx * t;
+                const float jy = wy + gy * t;
+                const float jz = wz + gz * t;
+                const float f = mx * jx + my * jy + mz * jz;
+                const float df = jx * jx + jy * jy + jz * jz + mx * gx + my * gy + mz * gz;
+                t = std::max(t - f / std::max(df, 1e-6f), 0.0f);
+            }
+            const float ht = 0.5f * t;
+            const float mx = (wx + gx * ht) * t - px;
+            const float my = (wy + gy * ht) * t - py;
+            const float mz = (wz + gz * ht) * t - pz;
+
+            const float ox = mx * sol.right[0] + my * sol.right[1] + mz * sol.right[2];
+            const float oy = mx * sol.up[0] + my * sol.up[1] + mz * sol.up[2];
+            const float dist2 = mx * mx + my * my + mz * mz;
+            const bool live = counter[l] < end;
+            const float w = live ? 1.0f : 0.0f;
+            acc_hits[l] += (live && dist2 <= r2) ? 1u : 0u;
+            acc_x[l] += w * ox;
+            acc_y[l] += w * oy;
+            acc_xx[l] += w * ox * ox;
+            acc_yy[l] += w * oy * oy;
+            acc_xy[l] += w * ox * oy;
+        }
+    }
+
+    ChunkSums sums = {};
+    sums.count = end - begin;
+    for (int l = 0; l < lane_count; ++l) {
+        sums.hits += acc_hits[l];
+        sums.sx += acc_x[l];
+        sums.sy += acc_y[l];
+        sums.sxx += acc_xx[l];
+        sums.syy += acc_yy[l];
+        sums.sxy += acc_xy[l];
+    }
+    return sums;
+}
+
+/**
+ * @brief
+ * Reduces a target's chunks in order and derives the error ellipse.
+ */
+static HitEstimate summarize(const Solution &sol, const ChunkSums *chunks, int n_chunks) {
+    ChunkSums total = {};
+    for (int i = 0; i < n_chunks; ++i) {
+        total.hits += chunks[i].hits;
+        total.count += chunks[i].count;
+        total.sx += chunks[i].sx;
+        total.sy += chunks[i].sy;
+        total.sxx += chunks[i].sxx;
+        total.syy += chunks[i].syy;
+        total.sxy += chunks[i].sxy;
+    }
+    HitEstimate est = {};
+    const double n = double(total.count);
+    const double p = double(total.hits) / n;
+    const double mx = total.sx / n;
+    const double my = total.sy / n;
+    const double cxx = std::max(total.sxx / n - mx * mx, 0.0);
+    const double cyy = std::max(total.syy / n - my * my, 0.0);
+    const double cxy = total.sxy / n - mx * my;
+    const double mid = 0.5 * (cxx + cyy);
+    const double dev = std::sqrt(0.25 * (cxx - cyy) * (cxx - cyy) + cxy * cxy);
+    est.probability = float(p);
+    est.std_error = float(std::sqrt(p * (1.0 - p) / n));
+    est.time_of_flight = sol.tof;
+    for (int a = 0; a < 3; ++a) {
+        est.aim_point[a] = sol.aim_point[a];
+    }
+    est.bias[0] = float(mx);
+    est.bias[1] = float(my);
+    est.sigma_major = float(std::sqrt(mid + dev));
+    est.sigma_minor = float(std::sqrt(std::max(mid - dev, 0.0)));
+    est.angle = float(0.5 * std::atan2(2.0 * cxy, cxx - cyy));
+    return est;
+}
+
+// --------------------------------- Estimator -------------------------------- //
+
+class HitEstimator {
+   public:
+    HitEstimator() = default;
+    HitEstimator(const HitEstimator &) = delete;
+    HitEstimator &operator=(const HitEstimator &) = delete;
+    HitEstimator(HitEstimator &&) = delete;
+    HitEstimator &operator=(HitEstimator &&) = delete;
+    ~HitEstimator() noexcept;
+
+    /**
+     * @brief
+     * Spawns n_threads - 1 workers, the calling thread is the last one.
+     */
+    HRESULT initialize(int n_threads);
+
+    HRESULT estimate(
+        const TargetState *targets,
+        int n_targets,
+        float speed,
+        float dispersion,
+        const float *gravity,
+        int n_samples,
+        std::uint64_t seed,
+        HitEstimate *out
+    );
+
+   private:
+    struct Job {
+        const TargetState *targets;
+        const Solution *solutions;
+        float speed;
+        float dispersion;
+        float gravity[3];
+        int n_samples;
+        int chunks_per_target;
+        int n_chunks;
+        std::uint64_t seed;
+    };
+
+    std::vector<std::thread> _workers = {};
+    std::vector<Solution> _solutions = {};
+    std::vector<ChunkSums> _chunks = {};
+    std::mutex _mutex = {};
+    std::condition_variable _job_cv = {};
+    std::condition_variable _done_cv = {};
+    std::atomic<int> _next_chunk{0};
+    Job _job = {};
+    std::uint64_t _generation = 0;
+    int _busy = 0;
+    bool _stop = false;
+
+    /**
+     * @brief
+     * Worker loop. Sleeps until a new generation is published.
+     */
+    void _worker_main();
+
+    /**
+     * @brief
+     * Claims and propagates chunks of the current job until none are left.
+     */
+    void _drain();
+};
+
+HitEstimator::~HitEstimator() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _job_cv.notify_all();
+    for (std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+HRESULT HitEstimator::initialize(int n_threads) {
+    if (n_threads <= 0) {
+        n_threads = int(std::max(std::thread::hardware_concurrency(), 1u));
+    }
+    _workers.reserve(n_threads - 1);
+    for (int i = 1; i < n_threads; ++i) {
+        _workers.emplace_back(&HitEstimator::_worker_main, this);
+    }
+    return S_OK;
+}
+
+void HitEstimator::_worker_main() {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _job_cv.wait(lock, [&] { return _stop || _generation != seen; });
+            if (_stop) {
+                return;
+            }
+            seen = _generation;
+        }
+        _drain();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_busy;
+        }
+        _done_cv.notify_one();
+    }
+}
+
+void HitEstimator::_drain() {
+    const Job &job = _job;
+    for (;;) {
+        const int chunk = _next_chunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= job.n_chunks) {
+            return;
+        }
+        const int target = chunk / job.chunks_per_target;
+        const Solution &sol = job.solutions[target];
+        if (!sol.valid) {
+            _chunks[chunk] = {};
+            continue;
+        }
+        const std::uint32_t begin = std::uint32_t(chunk % job.chunks_per_target) * chunk_samples;
+        const std::uint32_t end = std::min(begin + chunk_samples, std::uint32_t(job.n_samples));
+        _chunks[chunk] = propagate_chunk(
+            job.targets[target],
+            sol,
+            job.speed,
+            job.dispersion,
+            job.gravity,
+            std::uint32_t(target),
+            begin,
+            end,
+            job.seed
+        );
+    }
+}
+
+HRESULT HitEstimator::estimate(
+    const TargetState *targets,
+    int n_targets,
+    float speed,
+    float dispersion,
+    const float *gravity,
+    int n_samples,
+    std::uint64_t seed,
+    HitEstimate *out
+) {
+    if (!(speed > 0.0f && dispersion >= 0.0f && n_targets >= 0 && n_samples > 0)) {
+        return E_INVALIDARG;
+    }
+    // Chunk counts are computed wide, every worker overshoots the last chunk
+    // by one fetch_add, so the total must stay well below INT_MAX.
+    const std::int64_t wide_chunks_per_target =
+        (std::int64_t(n_samples) + chunk_samples - 1) / chunk_samples;
+    const std::int64_t wide_n_chunks = wide_chunks_per_target * n_targets;
+    if (wide_n_chunks > max_chunks) {
+        return E_INVALIDARG;
+    }
+    for (int i = 0; i < n_targets; ++i) {
+        const TargetState &tgt = targets[i];
+        bool ok = tgt.radius >= 0.0f;
+        for (int a = 0; a < 3; ++a) {
+            ok = ok && tgt.position_sigma[a] >= 0.0f && tgt.velocity_sigma[a] >= 0.0f;
+        }
+        if (!ok) {
+            return E_INVALIDARG;
+        }
+    }
+    if (n_targets == 0) {
+        return S_OK;
+    }
+
+    const int chunks_per_target = int(wide_chunks_per_target);
+    const int n_chunks = int(wide_n_chunks);
+    _solutions.resize(n_targets);
+    _chunks.resize(n_chunks);
+    for (int i = 0; i < n_targets; ++i) {
+        _solutions[i] = solve_intercept(targets[i], speed, gravity);
+    }
+
+    _job.targets = targets;
+    _job.solutions = _solutions.data();
+    _job.speed = speed;
+    _job.dispersion = dispersion;
+    std::copy(gravity, gravity + 3, _job.gravity);
+    _job.n_samples = n_samples;
+    _job.chunks_per_target = chunks_per_target;
+    _job.n_chunks = n_chunks;
+    _job.seed = seed;
+    _next_chunk.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = int(_workers.size());
+        ++_generation;
+    }
+    _job_cv.notify_all();
+    _drain();
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done_cv.wait(lock, [&] { return _busy == 0; });
+    }
+
+    for (int i = 0; i < n_targets; ++i) {
+        const Solution &sol = _solutions[i];
+        if (!sol.valid) {
+            out[i] = {};
+            out[i].time_of_flight = -1.0f;
+            continue;
+        }
+        out[i] = summarize(sol, &_chunks[std::size_t(i) * chunks_per_target], chunks_per_target);
+    }
+    return S_OK;
+}
+
+DLL_EXPORT HRESULT create_hit_estimator(HitEstimator **out, int n_threads) noexcept {
+    if (!out) {
+        return E_POINTER;
+    }
+    HitEstimator *obj = nullptr;
+    try {
+        obj = new HitEstimator();
+        HRESULT hr = obj->initialize(n_threads);
+        if (FAILED(hr)) {
+            delete obj;
+            return hr;
+        }
+        *out = obj;
+        return hr;
+    } catch (const std::bad_alloc &) {
+        delete obj;
+        return E_OUTOFMEMORY;
+    } catch (...) {
+        delete obj;
+        return E_FAIL;
+    }
+}
+
+DLL_EXPORT HRESULT estimate_hit_probability(
+    HitEstimator *obj,
+    const TargetState *targets,
+    int n_targets,
+    float speed,
+    float dispersion,
+    const float *gravity,
+    int n_samples,
+    std::uint64_t seed,
+    HitEstimate *out
+) noexcept {
+    if (!(obj && gravity && (n_targets == 0 || (targets && out)))) {
+        return E_POINTER;
+    }
+    try {
+        return obj->estimate(targets, n_targets, speed, dispersion, gravity, n_samples, seed, out);
+    } catch (const std::bad_alloc &) {
+        return E_OUTOFMEMORY;
+    } catch (...) {
+        return E_FAIL;
+    }
+}
+
+DLL_EXPORT void destroy_hit_estimator(HitEstimator **objptr) noexcept {
+    if (!objptr) {
+        return;
+    }
+    delete *objptr;
+    *objptr = nullptr;
+}
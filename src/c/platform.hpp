@@ -0,0 +1,34 @@
+/**
+ * @brief
+ * Platform shim shared by the native modules.
+ *
+ * @remarks
+ * - Status codes are HRESULTs on every platform. Non-Windows builds
+ *   get the subset used by the modules with identical values.
+ */
+
+#pragma once
+
+#ifdef _WIN32
+    #include <dxgi.h>
+    #include <winerror.h>
+
+    #define DLL_EXPORT __declspec(dllexport)
+#else
+    #include <cstdint>
+
+    #define DLL_EXPORT __attribute__((visibility("default")))
+
+using HRESULT = std::int32_t;
+
+    #define SUCCEEDED(hr) (static_cast<HRESULT>(hr) >= 0)
+    #define FAILED(hr) (static_cast<HRESULT>(hr) < 0)
+
+    #define S_OK static_cast<HRESULT>(0x00000000L)
+    #define S_FALSE static_cast<HRESULT>(0x00000001L)
+    #define E_FAIL static_cast<HRESULT>(0x80004005L)
+    #define E_POINTER static_cast<HRESULT>(0x80004003L)
+    #define E_INVALIDARG static_cast<HRESULT>(0x80070057L)
+    #define E_OUTOFMEMORY static_cast<HRESULT>(0x8007000EL)
+    #define DXGI_ERROR_WAIT_TIMEOUT static_cast<HRESULT>(0x887A0027L)
+#endif
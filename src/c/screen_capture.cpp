@@ -34,10 +34,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <new>
+
+#include "frame_source.hpp"
 
 namespace WRL = Microsoft::WRL;
 
-#define DLL_EXPORT __declspec(dllexport)
 #define RETURN_ON_HR_FAILURE(hr) \
     do {                         \
         if (FAILED(hr)) {        \
@@ -52,51 +54,25 @@ namespace WRL = Microsoft::WRL;
         }                                       \
     } while (false)
 
-struct ScreenCapture;
-
-extern "C" {
-
-/**
- * @brief
- * Primary entry point. Creates the object on memory
- * and provides a handle to the caller.
- */
-DLL_EXPORT HRESULT create_screen_capture_object(ScreenCapture **out) noexcept;
-
-/**
- * @brief
- * Capture current frame on the current buffer.
- *
- * @note
- * Data must be equal to the size of the monitor's resolution.
- * It must be formatted as B8G8R8A8.Behavior is undefined otherwise.
- */
-DLL_EXPORT HRESULT capture_frame(ScreenCapture *obj, void *data, int dx, int dy, int dz) noexcept;
-
-/**
- * @brief
- * Destroy screen capture object. Does nothing if a nullptr is passed.
- */
-DLL_EXPORT void destroy_screen_capture_object(ScreenCapture **objptr) noexcept;
-}
-
-class ScreenCapture {
+class ScreenCapture final : public FrameSource {
    public:
     ScreenCapture() = default;
 
-    /**
-     * @brief Primary initializer.
-     */
-    HRESULT initialize();
+    HRESULT initialize() override;
 
     /**
      * @brief
-     * Capture frame call. Copies duplicated output
-     * onto data out-parameter. Caller must provide size of
-     * data pointer in width and height and must ensure
-     * data is contiguous in memory.
+     * Copies duplicated output onto data out-parameter.
      */
-    HRESULT capture_frame(void *data, int dx, int dy, int dz);
+    HRESULT capture_frame(void *data, int dx, int dy, int dz) override;
+
+    int width() const noexcept override {
+        return _display_width;
+    }
+
+    int height() const noexcept override {
+        return _display_height;
+    }
 
    private:
     WRL::ComPtr<ID3D11Device> _d3ddevice = {};
@@ -137,7 +113,7 @@ HRESULT ScreenCapture::initialize() {
     return hr;
 }
 
-DLL_EXPORT HRESULT capture_frame(ScreenCapture *obj, void *data, int dx, int dy, int dz) noexcept {
+DLL_EXPORT HRESULT capture_frame(FrameSource *obj, void *data, int dx, int dy, int dz) noexcept {
     if (!(obj && data)) {
         return E_POINTER;
     }
@@ -254,7 +230,7 @@ HRESULT ScreenCapture::capture_frame(void *data, int dx, int dy, int dz) {
     return hr;
 }
 
-DLL_EXPORT HRESULT create_screen_capture_object(ScreenCapture **out) noexcept {
+DLL_EXPORT HRESULT create_screen_capture_object(FrameSource **out) noexcept {
     if (!out) {
         return E_POINTER;
     }
@@ -262,19 +238,26 @@ DLL_EXPORT HRESULT create_screen_capture_object(ScreenCapture **out) noexcept {
     try {
         auto *scrobj = new ScreenCapture();
         hr = scrobj->initialize();
-        RETURN_ON_HR_FAILURE(hr);
+        RETURN_ON_HR_FAILURE_ACTION(hr, delete scrobj);
         *out = scrobj;
+    } catch (const std::bad_alloc &) {
+        return E_OUTOFMEMORY;
     } catch (...) {
-        if (FAILED(hr)) {
-            return hr;
-        } else {
-            return E_FAIL;
-        }
+        return E_FAIL;
     }
     return hr;
 }
 
-DLL_EXPORT void destroy_screen_capture_object(ScreenCapture **objptr) noexcept {
+DLL_EXPORT HRESULT get_frame_size(FrameSource *obj, int *dx, int *dy) noexcept {
+    if (!(obj && dx && dy)) {
+        return E_POINTER;
+    }
+    *dx = obj->width();
+    *dy = obj->height();
+    return S_OK;
+}
+
+DLL_EXPORT void destroy_screen_capture_object(FrameSource **objptr) noexcept {
     if (!objptr) {
         return;
     }
@@ -0,0 +1,395 @@
+/**
+ * @brief
+ * X11 MIT-SHM screen capture implementation.
+ * Linux counterpart of the DXGI Desktop Duplication backend.
+ *
+ * @warning
+ * Does not support multi-monitor displays and
+ * visuals other than 24/32-bit TrueColor.
+ *
+ * @remarks
+ * - Frames are read by the X server straight into a shared memory
+ *   segment (XShmGetImage), the only copy is the hand-off to the caller.
+ * - Uses XDamage to skip frames where nothing on the root window changed.
+ *   These are reported as DXGI_ERROR_WAIT_TIMEOUT, same as the DXGI backend,
+ *   and the caller's buffer keeps the previous frame.
+ * - Falls back to capturing every call if XDamage is not available.
+ * - The fourth channel is whatever the server stores in the padding byte,
+ *   usually 0x00 on depth-24 visuals.
+ * - Works headlessly against Xvfb (e.g. `Xvfb :99 -screen 0 1920x1080x24`).
+ */
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <X11/extensions/Xdamage.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include "frame_source.hpp"
+
+#define RETURN_ON_HR_FAILURE(hr) \
+    do {                         \
+        if (FAILED(hr)) {        \
+            return hr;           \
+        }                        \
+    } while (false)
+
+/**
+ * @brief
+ * Scoped Xlib error trap. Xlib's default handler calls exit(), and
+ * requests like XShmAttach only report failure on the next round-trip.
+ * A syncing trap flushes on both ends so every error raised in between
+ * is caught. Requests that wait for a reply (XShmGetImage) already get
+ * their error synchronously and can skip the syncs.
+ *
+ * @remarks
+ * - Only errors for the trapped display are recorded, anything else is
+ *   forwarded to the handler that was installed before.
+ *
+ * @warning
+ * The handler is process-wide, traps must not overlap across threads.
+ */
+class XErrorTrap {
+   public:
+    XErrorTrap(Display *display, bool sync);
+    XErrorTrap(const XErrorTrap &) = delete;
+    XErrorTrap &operator=(const XErrorTrap &) = delete;
+    XErrorTrap(XErrorTrap &&) = delete;
+    XErrorTrap &operator=(XErrorTrap &&) = delete;
+    ~XErrorTrap() noexcept;
+
+    /**
+     * @brief
+     * Flushes pending requests if syncing, restores the previous handler
+     * and maps the first trapped error onto an HRESULT (S_OK if none).
+     */
+    HRESULT release() noexcept;
+
+   private:
+    Display *_display = nullptr;
+    bool _sync = true;
+    bool _released = false;
+
+    static Display *_trapped;
+    static XErrorHandler _previous;
+    static int _error_code;
+    static int _handler(Display *display, XErrorEvent *event);
+};
+
+Display *XErrorTrap::_trapped = nullptr;
+XErrorHandler XErrorTrap::_previous = nullptr;
+int XErrorTrap::_error_code = Success;
+
+XErrorTrap::XErrorTrap(Display *display, bool sync) : _display(display), _sync(sync) {
+    if (_sync) {
+        XSync(_display, False);
+    }
+    _trapped = _display;
+    _error_code = Success;
+    _previous = XSetErrorHandler(&XErrorTrap::_handler);
+}
+
+XErrorTrap::~XErrorTrap() noexcept {
+    release();
+}
+
+int XErrorTrap::_handler(Display *display, XErrorEvent *event) {
+    if (display != _trapped) {
+        return _previous ? _previous(display, event) : 0;
+    }
+    if (_error_code == Success) {
+        _error_code = event->error_code;
+    }
+    return 0;
+}
+
+HRESULT XErrorTrap::release() noexcept {
+    if (!_released) {
+        if (_sync) {
+            XSync(_display, False);
+        }
+        XSetErrorHandler(_previous);
+        _trapped = nullptr;
+        _released = true;
+    }
+    switch (_error_code) {
+        case Success: return S_OK;
+        case BadAlloc: return E_OUTOFMEMORY;
+        default: return E_FAIL;
+    }
+}
+
+class X11ScreenCapture final : public FrameSource {
+   public:
+    X11ScreenCapture() = default;
+    ~X11ScreenCapture() noexcept override;
+
+    HRESULT initialize() override;
+
+    /**
+     * @brief
+     * Copies the shared memory image onto data out-parameter.
+     * Returns DXGI_ERROR_WAIT_TIMEOUT if the screen has not changed
+     * since the previous call.
+     */
+    HRESULT capture_frame(void *data, int dx, int dy, int dz) override;
+
+    int width() const noexcept override {
+        return _display_width;
+    }
+
+    int height() const noexcept override {
+        return _display_height;
+    }
+
+   private:
+    Display *_display = nullptr;
+    Window _root = 0;
+    XImage *_ximage = nullptr;
+    XShmSegmentInfo _shminfo = {};
+    bool _shm_attached = false;
+    Damage _damage = 0;
+    int _damage_event_base = 0;
+    bool _dirty = true;  // Forces the first capture.
+    int _display_width = 0;
+    int _display_height = 0;
+
+    /**
+     * @brief
+     * Sets up the shared memory XImage and
+     * attaches the segment to the server.
+     */
+    HRESULT _create_shm_image();
+
+    /**
+     * @brief
+     * Sets up damage tracking on the root window.
+     * Leaves _damage at 0 if the extension is missing.
+     */
+    void _create_damage_tracker();
+
+    /**
+     * @brief
+     * Drains pending events and reports whether the root
+     * window has been damaged since the last capture.
+     */
+    bool _poll_damage();
+};
+
+X11ScreenCapture::~X11ScreenCapture() noexcept {
+    if (_display && _damage) {
+        XDamageDestroy(_display, _damage);
+    }
+    if (_display && _shm_attached) {
+        XShmDetach(_display, &_shminfo);
+        XSync(_display, False);
+    }
+    if (_ximage) {
+        _ximage->data = nullptr;  // Owned by the shm segment, not Xlib.
+        XDestroyImage(_ximage);
+    }
+    if (_shminfo.shmaddr) {
+        shmdt(_shminfo.shmaddr);
+    }
+    if (_display) {
+        XCloseDisplay(_display);
+    }
+}
+
+HRESULT X11ScreenCapture::initialize() {
+    _display = XOpenDisplay(nullptr);
+    if (!_display) {
+        return E_FAIL;
+    }
+    if (!XShmQueryExtension(_display)) {
+        return E_FAIL;
+    }
+    _root = DefaultRootWindow(_display);
+    _display_width = DisplayWidth(_display, DefaultScreen(_display));
+    _display_height = DisplayHeight(_display, DefaultScreen(_display));
+    HRESULT hr = _create_shm_image();
+    RETURN_ON_HR_FAILURE(hr);
+    _create_damage_tracker();
+    return hr;
+}
+
+HRESULT X11ScreenCapture::_create_shm_image() {
+    const int screen = DefaultScreen(_display);
+    Visual *visual = DefaultVisual(_display, screen);
+    const int depth = DefaultDepth(_display, screen);
+    if (visual->c_class != TrueColor || (depth != 24 && depth != 32)) {
+        return E_FAIL;
+    }
+    _ximage = XShmCreateImage(
+        _display,
+        visual,
+        depth,
+        ZPixmap,
+        nullptr,
+        &_shminfo,
+        _display_width,
+        _display_height
+    );
+    if (!_ximage) {
+        return E_FAIL;
+    }
+    if (_ximage->bits_per_pixel != 32 || _ximage->byte_order != LSBFirst) {
+        return E_FAIL;  // Not BGRA in memory.
+    }
+
+    // Marked for removal right away, the segment lives until both sides detach.
+    const std::size_t size = std::size_t(_ximage->bytes_per_line) * _ximage->height;
+    _shminfo.shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+    if (_shminfo.shmid < 0) {
+        return E_OUTOFMEMORY;
+    }
+    _shminfo.shmaddr = static_cast<char *>(shmat(_shminfo.shmid, nullptr, 0));
+    if (_shminfo.shmaddr == reinterpret_cast<char *>(-1)) {
+        _shminfo.shmaddr = nullptr;
+        shmctl(_shminfo.shmid, IPC_RMID, nullptr);
+        return E_OUTOFMEMORY;
+    }
+    _ximage->data = _shminfo.shmaddr;
+    _shminfo.readOnly = False;
+
+    // Fails asynchronously on remote displays or across IPC namespaces.
+    XErrorTrap trap(_display, true);
+    const Bool attached = XShmAttach(_display, &_shminfo);
+    HRESULT hr = trap.release();
+    shmctl(_shminfo.shmid, IPC_RMID, nullptr);
+    if (SUCCEEDED(hr) && !attached) {
+        hr = E_FAIL;
+    }
+    if (FAILED(hr)) {
+        _ximage->data = nullptr;
+        shmdt(_shminfo.shmaddr);
+        _shminfo.shmaddr = nullptr;
+        return hr;
+    }
+    _shm_attached = true;
+    return S_OK;
+}
+
+void X11ScreenCapture::_create_damage_tracker() {
+    int error_base = 0;
+    if (!XDamageQueryExtension(_display, &_damage_event_base, &error_base)) {
+        return;
+    }
+    XErrorTrap trap(_display, true);
+    _damage = XDamageCreate(_display, _root, XDamageReportNonEmpty);
+    if (FAILED(trap.release())) {
+        _damage = 0;  // Never created, capture every call instead.
+    }
+}
+
+bool X11ScreenCapture::_poll_damage() {
+    if (!_damage) {
+        return true;
+    }
+    bool damaged = false;
+    XEvent event = {};
+    while (XPending(_display)) {
+        XNextEvent(_display, &event);
+        if (event.type == _damage_event_base + XDamageNotify) {
+            damaged = true;
+        }
+    }
+    return damaged;
+}
+
+HRESULT X11ScreenCapture::capture_frame(void *data, int dx, int dy, int dz) {
+    constexpr int channel_count = 4;  // BGRA.
+    if (!data) {
+        return E_POINTER;
+    }
+    if (!(dy == _display_height && dx == _display_width && dz == channel_count)) {
+        return E_INVALIDARG;
+    }
+    _dirty = _poll_damage() || _dirty;
+    if (!_dirty) {
+        return DXGI_ERROR_WAIT_TIMEOUT;
+    }
+
+    // Reset before grabbing so damage raised during the grab
+    // is reported on the next call instead of being lost.
+    if (_damage) {
+        XDamageSubtract(_display, _damage, None, None);
+    }
+    XErrorTrap trap(_display, false);  // Round-trip already, no syncs per frame.
+    const Bool grabbed = XShmGetImage(_display, _root, _ximage, 0, 0, AllPlanes);
+    HRESULT hr = trap.release();
+    RETURN_ON_HR_FAILURE(hr);
+    if (!grabbed) {
+        return E_FAIL;
+    }
+    _dirty = false;
+
+    const std::size_t dst_stride = std::size_t(dx) * channel_count;
+    const std::size_t src_stride = _ximage->bytes_per_line;
+    if (src_stride == dst_stride) {
+        std::memcpy(data, _ximage->data, dst_stride * dy);
+    } else {
+        const std::uint8_t *__restrict src = reinterpret_cast<std::uint8_t *>(_ximage->data);
+        std::uint8_t *__restrict dst = static_cast<std::uint8_t *>(data);
+        for (int i = 0; i < dy; ++i) {
+            std::memcpy(dst, src, dst_stride);
+            src += src_stride;
+            dst += dst_stride;
+        }
+    }
+    return S_OK;
+}
+
+DLL_EXPORT HRESULT capture_frame(FrameSource *obj, void *data, int dx, int dy, int dz) noexcept {
+    if (!(obj && data)) {
+        return E_POINTER;
+    }
+    try {
+        return obj->capture_frame(data, dx, dy, dz);
+    } catch (...) {
+        return E_FAIL;
+    }
+}
+
+DLL_EXPORT HRESULT create_screen_capture_object(FrameSource **out) noexcept {
+    if (!out) {
+        return E_POINTER;
+    }
+    try {
+        auto *scrobj = new X11ScreenCapture();
+        HRESULT hr = scrobj->initialize();
+        if (FAILED(hr)) {
+            delete scrobj;
+            return hr;
+        }
+        *out = scrobj;
+        return hr;
+    } catch (const std::bad_alloc &) {
+        return E_OUTOFMEMORY;
+    } catch (...) {
+        return E_FAIL;
+    }
+}
+
+DLL_EXPORT HRESULT get_frame_size(FrameSource *obj, int *dx, int *dy) noexcept {
+    if (!(obj && dx && dy)) {
+        return E_POINTER;
+    }
+    *dx = obj->width();
+    *dy = obj->height();
+    return S_OK;
+}
+
+DLL_EXPORT void destroy_screen_capture_object(FrameSource **objptr) noexcept {
+    if (!objptr) {
+        return;
+    }
+    delete *objptr;
+    *objptr = nullptr;
+}
@@ -0,0 +1,196 @@
+/**
+ * @brief
+ * Statistical tests and samples/s benchmark for the hit-probability estimator.
+ *
+ * @remarks
+ * - Includes the translation unit directly to reach the RNG internals.
+ * - Build with the same flags as build_dll.py, e.g.
+ *   c++ -std=c++17 -O3 -fno-math-errno -fno-trapping-math -pthread
+ *       tests/hit_probability_test.cpp -o hit_probability_test
+ * - Returns non-zero if any check fails. Driven by test_hit_probability.py.
+ */
+
+#include "../src/c/hit_probability.cpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            std::printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures;                                                \
+        }                                                              \
+    } while (false)
+
+static const float no_gravity[3] = {0.0f, 0.0f, 0.0f};
+static const float earth_gravity[3] = {0.0f, -9.81f, 0.0f};
+
+/**
+ * @brief
+ * Philox4x32-10 known-answer vector from Random123, counter = key = 0.
+ */
+static void test_philox_kat() {
+    std::uint32_t counter[lane_count] = {};
+    std::uint32_t out[4][lane_count];
+    philox4x32(counter, 0, 0, 0, out);
+    CHECK(out[0][0] == 0x6627E8D5u);
+    CHECK(out[1][0] == 0xE169C58Du);
+    CHECK(out[2][0] == 0xBC57AC4Cu);
+    CHECK(out[3][0] == 0x9B00DBD8u);
+}
+
+static void test_to_unit_bounds() {
+    CHECK(to_unit(0u) > 0.0f);
+    CHECK(to_unit(0xFFFFFFFFu) < 1.0f);
+}
+
+/**
+ * @brief
+ * Stationary target, isotropic position sigma and radius = 1 sigma.
+ * The miss vector is 2D Gaussian on the plane normal to the line of fire,
+ * so the hit probability is Rayleigh: 1 - exp(-0.5).
+ */
+static void test_rayleigh(HitEstimator *obj) {
+    const TargetState target = {{0, 0, 1000}, {0, 0, 0}, {2, 2, 2}, {0, 0, 0}, 2};
+    const double expected = 1.0 - std::exp(-0.5);
+    for (std::uint64_t seed = 0; seed < 4; ++seed) {
+        HitEstimate est = {};
+        CHECK(SUCCEEDED(
+            estimate_hit_probability(obj, &target, 1, 800, 0, no_gravity, 1 << 20, seed, &est)
+        ));
+        std::printf("rayleigh seed %llu: p=%f +- %f (expected %f)\n",
+                    static_cast<unsigned long long>(seed),
+                    est.probability,
+                    est.std_error,
+                    expected);
+        CHECK(std::abs(est.probability - expected) <= 4.0 * est.std_error);
+        CHECK(std::abs(est.sigma_major - 2.0f) < 0.02f);
+        CHECK(std::abs(est.sigma_minor - 2.0f) < 0.02f);
+    }
+}
+
+/**
+ * @brief
+ * Angular dispersion alone, sigma * range acts as the position sigma.
+ */
+static void test_dispersion(HitEstimator *obj) {
+    const TargetState target = {{0, 0, 1000}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, 2};
+    const double expected = 1.0 - std::exp(-0.5);
+    HitEstimate est = {};
+    CHECK(SUCCEEDED(
+        estimate_hit_probability(obj, &target, 1, 800, 0.002f, no_gravity, 1 << 20, 9, &est)
+    ));
+    CHECK(std::abs(est.probability - expected) <= 4.0 * est.std_error);
+}
+
+static void test_deterministic_target(HitEstimator *obj) {
+    const TargetState targets[2] = {
+        {{100, 5, 800}, {20, 0, -5}, {0, 0, 0}, {0, 0, 0}, 2},
+        {{0, 0, 100}, {0, 0, 2000}, {0, 0, 0}, {0, 0, 0}, 2},  // Outruns the projectile.
+    };
+    HitEstimate est[2] = {};
+    CHECK(SUCCEEDED(
+        estimate_hit_probability(obj, targets, 2, 800, 0, earth_gravity, 4096, 1, est)
+    ));
+    CHECK(est[0].probability == 1.0f);
+    CHECK(est[0].time_of_flight > 0.0f);
+    CHECK(est[1].probability == 0.0f);
+    CHECK(est[1].time_of_flight < 0.0f);
+}
+
+static void test_invalid_args(HitEstimator *obj) {
+    const TargetState target = {{0, 0, 100}, {0, 0, 0}, {-1, 0, 0}, {0, 0, 0}, 1};
+    HitEstimate est = {};
+    CHECK(estimate_hit_probability(obj, &target, 1, 800, 0, no_gravity, 16, 0, &est) ==
+          E_INVALIDARG);
+    CHECK(estimate_hit_probability(nullptr, &target, 1, 800, 0, no_gravity, 16, 0, &est) ==
+          E_POINTER);
+
+    // Chunk count overflows int, rejected before any target is read.
+    const int max_samples = std::numeric_limits<int>::max();
+    CHECK(estimate_hit_probability(obj, &target, 4096, 800, 0, no_gravity, max_samples, 0, &est) ==
+          E_INVALIDARG);
+}
+
+static std::vector<TargetState> make_targets(int n) {
+    std::vector<TargetState> targets(n);
+    for (int i = 0; i < n; ++i) {
+        targets[i] = {
+            {float(10 * i - 300), 5, float(400 + 10 * i)},
+            {20, 0, -5},
+            {1, 1, 1},
+            {2, 2, 2},
+            2,
+        };
+    }
+    return targets;
+}
+
+/**
+ * @brief
+ * Same seed, same output: across repeated calls and across thread counts.
+ */
+static void test_reproducible(HitEstimator *single, HitEstimator *multi) {
+    const std::vector<TargetState> targets = make_targets(7);
+    const int n = int(targets.size());
+    std::vector<HitEstimate> a(n), b(n), c(n), d(n);
+    const int samples = 3 * chunk_samples + 123;  // Partial chunk and partial lane block.
+    const auto run = [&](HitEstimator *obj, std::uint64_t seed, HitEstimate *out) {
+        estimate_hit_probability(
+            obj, targets.data(), n, 800, 0.002f, earth_gravity, samples, seed, out
+        );
+    };
+    run(single, 42, a.data());
+    run(multi, 42, b.data());
+    run(multi, 42, c.data());
+    run(multi, 43, d.data());
+    CHECK(std::memcmp(a.data(), b.data(), n * sizeof(HitEstimate)) == 0);
+    CHECK(std::memcmp(b.data(), c.data(), n * sizeof(HitEstimate)) == 0);
+    CHECK(std::memcmp(c.data(), d.data(), n * sizeof(HitEstimate)) != 0);
+}
+
+static void bench(HitEstimator *obj, const char *label) {
+    const std::vector<TargetState> targets = make_targets(64);
+    std::vector<HitEstimate> out(targets.size());
+    constexpr int samples = 1 << 16;
+    constexpr int reps = 5;
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        const int n = int(targets.size());
+        estimate_hit_probability(
+            obj, targets.data(), n, 800, 0.002f, earth_gravity, samples, r, out.data()
+        );
+    }
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double total = double(targets.size()) * samples * reps;
+    std::printf("bench %s: %.1f M samples/s\n", label, total / seconds / 1e6);
+}
+
+int main() {
+    HitEstimator *single = nullptr;
+    HitEstimator *multi = nullptr;
+    if (FAILED(create_hit_estimator(&single, 1)) || FAILED(create_hit_estimator(&multi, 8))) {
+        std::printf("FAIL: create_hit_estimator\n");
+        return 1;
+    }
+    test_philox_kat();
+    test_to_unit_bounds();
+    test_rayleigh(multi);
+    test_dispersion(multi);
+    test_deterministic_target(multi);
+    test_invalid_args(multi);
+    test_reproducible(single, multi);
+    bench(single, "1 thread");
+    bench(multi, "8 threads");
+    destroy_hit_estimator(&single);
+    destroy_hit_estimator(&multi);
+    std::printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
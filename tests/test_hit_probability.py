@@ -0,0 +1,73 @@
+"""
+Runs the native hit-probability tests and benchmark, then checks the
+ctypes wrapper against the built library.
+
+    python -m unittest discover tests
+"""
+
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+ROOT: Path = Path(__file__).resolve().parents[1]
+sys.path.insert(0, str(ROOT / "src"))
+
+NATIVE_TEST: Path = Path(__file__).resolve().parent / "hit_probability_test.cpp"
+SO_NAME: str = "hit_probability.dll" if sys.platform == "win32" else "hit_probability.so"
+SO_PATH: Path = ROOT / "src" / "a_to_b" / "dlls" / SO_NAME
+
+
+class TestHitProbabilityNative(unittest.TestCase):
+    @unittest.skipUnless(shutil.which("c++"), "no C++ compiler")
+    def test_native(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            binary: Path = Path(tmp) / "hit_probability_test"
+            build = subprocess.run(
+                [
+                    "c++",
+                    "-std=c++17",
+                    "-O3",
+                    "-fno-math-errno",
+                    "-fno-trapping-math",
+                    "-pthread",
+                    str(NATIVE_TEST),
+                    "-o",
+                    str(binary),
+                ],
+                capture_output=True,
+                text=True,
+            )
+            self.assertEqual(build.returncode, 0, build.stderr)
+            run = subprocess.run([str(binary)], capture_output=True, text=True)
+            print(run.stdout, end="")
+            self.assertEqual(run.returncode, 0, run.stdout)
+
+
+@unittest.skipUnless(SO_PATH.exists(), f"{SO_NAME} is not built")
+class TestHitProbabilityWrapper(unittest.TestCase):
+    def test_wrapper(self) -> None:
+        import numpy as np
+        from a_to_b.hit_probability import ESTIMATE_FIELDS, HitEstimator
+
+        targets = np.array(
+            [
+                [100, 5, 800, 20, 0, -5, 1, 1, 1, 2, 2, 2, 2],
+                [0, 0, 100, 0, 0, 2000, 0, 0, 0, 0, 0, 0, 2],
+            ],
+            dtype=np.float32,
+        )
+        a = HitEstimator(1).estimate(targets, 800, 0.002, seed=7)
+        b = HitEstimator(4).estimate(targets, 800, 0.002, seed=7)
+        self.assertEqual(a.shape, (2, ESTIMATE_FIELDS))
+        self.assertTrue((a == b).all())
+        self.assertTrue(0.0 < a[0, 0] < 1.0)
+        self.assertLess(a[1, 2], 0.0)  # No intercept.
+        with self.assertRaises(SystemError):
+            HitEstimator(1).estimate(targets, -1.0, 0.002)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,157 @@
+"""
+Headless smoke test for the X11 MIT-SHM capture backend.
+
+Runs against a private Xvfb server on a free display and is skipped
+when Xvfb or the built backend (`python build_dll.py`) is unavailable.
+
+    python -m unittest discover tests
+"""
+
+import ctypes
+import ctypes.util
+import os
+import select
+import shutil
+import subprocess
+import sys
+import time
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1] / "src"))
+
+WIDTH: int = 640
+HEIGHT: int = 480
+N_CHANNELS: int = 4
+SO_PATH: Path = Path(__file__).resolve().parents[1] / "src" / "a_to_b" / "dlls" / "screen_capture.so"
+
+
+def _load_xlib() -> ctypes.CDLL:
+    xlib: ctypes.CDLL = ctypes.CDLL(ctypes.util.find_library("X11"))
+    xlib.XOpenDisplay.restype = ctypes.c_void_p
+    xlib.XOpenDisplay.argtypes = (ctypes.c_char_p,)
+    xlib.XDefaultRootWindow.restype = ctypes.c_ulong
+    xlib.XDefaultRootWindow.argtypes = (ctypes.c_void_p,)
+    xlib.XCreateGC.restype = ctypes.c_void_p
+    xlib.XCreateGC.argtypes = (ctypes.c_void_p, ctypes.c_ulong, ctypes.c_ulong, ctypes.c_void_p)
+    xlib.XSetForeground.argtypes = (ctypes.c_void_p, ctypes.c_void_p, ctypes.c_ulong)
+    xlib.XFillRectangle.argtypes = (
+        ctypes.c_void_p,
+        ctypes.c_ulong,
+        ctypes.c_void_p,
+        ctypes.c_int,
+        ctypes.c_int,
+        ctypes.c_uint,
+        ctypes.c_uint,
+    )
+    xlib.XSync.argtypes = (ctypes.c_void_p, ctypes.c_int)
+    xlib.XFreeGC.argtypes = (ctypes.c_void_p, ctypes.c_void_p)
+    xlib.XCloseDisplay.argtypes = (ctypes.c_void_p,)
+    return xlib
+
+
+def _fill_root(display: str, x: int, y: int, w: int, h: int, rgb: int) -> None:
+    xlib: ctypes.CDLL = _load_xlib()
+    dpy = xlib.XOpenDisplay(display.encode())
+    root = xlib.XDefaultRootWindow(dpy)
+    gc = xlib.XCreateGC(dpy, root, 0, None)
+    xlib.XSetForeground(dpy, gc, rgb)
+    xlib.XFillRectangle(dpy, root, gc, x, y, w, h)
+    xlib.XSync(dpy, 0)
+    xlib.XFreeGC(dpy, gc)
+    xlib.XCloseDisplay(dpy)
+
+
+@unittest.skipUnless(shutil.which("Xvfb"), "Xvfb is not installed")
+@unittest.skipUnless(SO_PATH.exists(), "screen_capture.so is not built")
+class TestX11ScreenCapture(unittest.TestCase):
+    _xvfb: subprocess.Popen | None = None
+    _display: str = ""
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        # -displayfd picks a free display and writes its number once the server is ready.
+        read_fd, write_fd = os.pipe()
+        cls._xvfb = subprocess.Popen(
+            [
+                "Xvfb",
+                "-displayfd",
+                str(write_fd),
+                "-screen",
+                "0",
+                f"{WIDTH}x{HEIGHT}x24",
+                "-br",
+                "-nolisten",
+                "tcp",
+            ],
+            pass_fds=(write_fd,),
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.PIPE,
+        )
+        os.close(write_fd)
+        number: str = ""
+        with os.fdopen(read_fd) as pipe:
+            if select.select([pipe], [], [], 10.0)[0]:
+                number = pipe.readline().strip()
+        if not number and cls._xvfb.poll() is None:
+            cls._xvfb.kill()  # Hung without ever reporting a display.
+        if cls._xvfb.poll() is not None or not number:
+            stderr: str = cls._xvfb.communicate()[1].decode(errors="replace")
+            cls._xvfb = None
+            raise RuntimeError(f"Xvfb failed to start:\n{stderr}")
+        cls._display = f":{number}"
+        os.environ["DISPLAY"] = cls._display
+
+    @classmethod
+    def tearDownClass(cls) -> None:
+        if cls._xvfb is not None:
+            cls._xvfb.terminate()
+            cls._xvfb.communicate()
+
+    def test_capture(self) -> None:
+        import numpy as np
+        import a_to_b.screen_capture as sc
+
+        wrapper = sc.ScreenCapture()
+        self.assertEqual(wrapper.capture().shape, (HEIGHT, WIDTH, N_CHANNELS))
+
+        handle = ctypes.c_void_p()
+        self.assertGreaterEqual(sc.SCRDLL.create_screen_capture_object(ctypes.byref(handle)), 0)
+        try:
+            sx, sy = ctypes.c_int(), ctypes.c_int()
+            self.assertEqual(sc.SCRDLL.get_frame_size(handle, ctypes.byref(sx), ctypes.byref(sy)), 0)
+            self.assertEqual((sx.value, sy.value), (WIDTH, HEIGHT))
+
+            frame = np.full((HEIGHT, WIDTH, N_CHANNELS), 0x5A, dtype=np.uint8)
+
+            def capture() -> int:
+                return sc.SCRDLL.capture_frame(
+                    handle, frame.ctypes.data_as(ctypes.c_void_p), WIDTH, HEIGHT, N_CHANNELS
+                )
+
+            # First call always grabs.
+            self.assertEqual(capture(), 0)
+            self.assertTrue((frame[..., :3] == 0).all())  # -br, black root.
+
+            # Nothing drawn, buffer is left as-is.
+            before = frame.copy()
+            self.assertEqual(capture(), sc.WAIT_TIMEOUT)
+            self.assertTrue((frame == before).all())
+
+            _fill_root(self._display, 10, 20, 30, 40, 0xFF8000)
+            hr: int = sc.WAIT_TIMEOUT
+            for _ in range(50):
+                hr = capture()
+                if hr != sc.WAIT_TIMEOUT:
+                    break
+                time.sleep(0.01)
+            self.assertEqual(hr, 0)
+            self.assertEqual(tuple(frame[20, 10, :3]), (0x00, 0x80, 0xFF))  # BGR.
+            self.assertEqual(tuple(frame[59, 39, :3]), (0x00, 0x80, 0xFF))
+            self.assertTrue((frame[60, 40, :3] == 0).all())
+        finally:
+            sc.SCRDLL.destroy_screen_capture_object(ctypes.byref(handle))
+
+
+if __name__ == "__main__":
+    unittest.main()